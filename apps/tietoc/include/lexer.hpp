@@ -12,12 +12,20 @@ class Lexer {
     const char* curr = nullptr;
     // Number of line in the source code at which current token starts.
     unsigned int line = 1;
-    // Number of column in the source code at which current token starts. Does not account for the tabulation mark's length and assumes it is equal to one.
+    // Number of column in the source code at which the currently analysed character is. Counted in code points, not bytes. Does not account for the tabulation mark's length and assumes it is equal to one.
     unsigned int column = 1;
+    // Number of column in the source code at which current token starts.
+    unsigned int startColumn = 1;
     // Function skipping all whitespace characters (`\n` is not considered whitespace).
     void skipWhitespace();
-    // Helper function moving to the next character and returning previous one.
+    // Helper function moving to the next byte and returning previous one.
     char next();
+    // Helper function moving to the given position within the current line, counting every byte as a column. ASCII runs are scanned with a local pointer and committed with this function, so that `curr` and `column` are not written back on every byte.
+    void advance(const char* end);
+    // Helper function moving past the rest of the multi-byte character whose leading byte has already been consumed. Does not advance `column`.
+    void skipContinuation();
+    // This function returns information on whether the current non-ASCII character can continue an identifier. Moves past the whole character if true. ASCII characters shall be handled by the caller.
+    bool nextIsXIDContinue();
     // This function returns information on whether the current character in the source is the given one. Moves to the next character if true.
     bool nextIs(char c);
     // Helper function returning token with given type and other fields computed.
@@ -25,7 +33,7 @@ class Lexer {
     // Flag method returning information on whether the lexer has reached end of file. Sets `src` to `nullptr` when true.
     bool isEOF();
     public:
-        // This method configures lexer for tokenization. It should be always called before tokenizing the code. Throws an exception when already configured.
+        // This method configures lexer for tokenization. It should be always called before tokenizing the code. Throws an exception when already configured or when the source is not valid UTF-8.
         void configure(const char* source);
         // This method yields next token from the source code. Throws an exception when lexer is not configured.
         Token nextToken();
@@ -67,6 +67,6 @@ struct Token {
     unsigned int length;
     // Number of line in the source code at which the token appeared.
     unsigned int line;
-    // Number of column in the source code at which the token appeared. May not work well with tabulation characters as their length is unspecified.
+    // Number of column in the source code at which the token appeared, counted in code points. May not work well with tabulation characters as their length is unspecified.
     unsigned int column;
 };
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// This function validates whether the given buffer is well-formed UTF-8 and returns pointer to the first byte of the first invalid sequence, or `nullptr` if the whole buffer is valid.
+// Runs of ASCII bytes are skipped using SIMD instructions when available, therefore pure-ASCII sources are validated at memory speed.
+const char* validateUtf8(const char* src, std::size_t length);
+// This function decodes a single code point starting at `src` and moves the pointer past it. Assumes the sequence has already been validated.
+uint32_t decodeUtf8(const char*& src);
+// Flag function returning information on whether the code point has the Unicode `XID_Start` property. Intended for non-ASCII code points, ASCII ones should be handled by the caller.
+bool isXIDStart(uint32_t codepoint);
+// Flag function returning information on whether the code point has the Unicode `XID_Continue` property. Intended for non-ASCII code points, ASCII ones should be handled by the caller.
+bool isXIDContinue(uint32_t codepoint);
@@ -1,18 +1,33 @@
 #include <lexer.hpp>
+#include <unicode.hpp>
 #include <stdexcept>
+#include <string>
 #include <cstring>
 
 void Lexer::configure(const char* source) {
     if (isTokenizing()) throw std::runtime_error("Lexer::configure(): Lexer is already configured. Call this method after tokenization is finished.");
+    // Encoding is validated up front, so that tokenization may assume well-formed UTF-8.
+    if (const char* invalid = validateUtf8(source, strlen(source))) {
+        // Position of the invalid byte is computed the same way as tokens' ones, so the diagnostic points at line and code point column.
+        unsigned int errLine = 1, errColumn = 1;
+        for (const char* c = source; c < invalid; c++) {
+            if (*c == '\n') {
+                errLine++;
+                errColumn = 1;
+            } else if (*c != '\r' && (static_cast<unsigned char>(*c) & 0xC0) != 0x80) errColumn++;
+        }
+        throw std::runtime_error("Lexer::configure(): Source is not valid UTF-8 (invalid byte at " + std::to_string(errLine) + ":" + std::to_string(errColumn) + ").");
+    }
     // Set all properties to starting values
     start = curr = src = source;
-    line = column = 1;
+    line = column = startColumn = 1;
 }
 Token Lexer::nextToken() {
     if (!isTokenizing()) throw std::runtime_error("Lexer::nextToken(): Lexer is not configured for tokenization. Call `configure(source)` method first.");
     // Move to the start of the next token
     skipWhitespace();
     start = curr;
+    startColumn = column;
     // Handle end of file
     if (isEOF()) {
         src = nullptr;
@@ -70,21 +85,30 @@ Token Lexer::nextToken() {
             if (nextIs('>')) return token(TT_STREAM);
             else return token(TT_ERRCHAR);
         case '"': {
-            // Properties `line` and `column` are buffered to handle multi-line string literals.
-            unsigned int tempLine = line, tempCol = column;
-            while (!isEOF() && *curr != '"') {
-                // Handling for multi-line string literals.
+            // Property `line` is buffered to handle multi-line string literals.
+            unsigned int tempLine = line;
+            for (;;) {
+                // Printable ASCII characters after `"` cannot end the literal, so they are scanned with a single range check.
+                const char* end = curr;
+                unsigned char c;
+                while ((c = static_cast<unsigned char>(*end)) > '"' && c < 0x80) end++;
+                advance(end);
+                if (isEOF() || *curr == '"') break;
+                // Handling for multi-line string literals. Newline is consumed before resetting the column, so the next line starts at column 1.
                 if (*curr == '\n') {
+                    next();
                     line++;
                     column = 1;
+                } else {
+                    next();
+                    skipContinuation();
                 }
-                next();
             }
             // If EOF was encountered before closing `"`, it is an error.
-            if (isEOF()) return {TT_ERRSTR, start, static_cast<unsigned int>(curr - start), tempLine, tempCol};
+            if (isEOF()) return {TT_ERRSTR, start, static_cast<unsigned int>(curr - start), tempLine, startColumn};
             // Closing `"`.
             next();
-            return {TT_STRING, start, static_cast<unsigned int>(curr - start), tempLine, tempCol};
+            return {TT_STRING, start, static_cast<unsigned int>(curr - start), tempLine, startColumn};
         }
         case '\n': {
             // This is done so that token's `line` and `column` fields point to first line's end instead of second line's beginning.
@@ -93,10 +117,23 @@ Token Lexer::nextToken() {
             column = 1;
             return temp;
         }
-        default:
-            if (isalpha(*start) || *start == '_') {
-                // Read whole token
-                while (!isEOF() && (isalnum(*curr) || *curr == '_')) next();
+        default: {
+            unsigned char first = static_cast<unsigned char>(*start);
+            bool isIdStart = isalpha(first) || first == '_';
+            // Non-ASCII characters are looked up in the Unicode tables only here, so pure-ASCII sources never leave the fast path.
+            if (first >= 0x80) {
+                const char* temp = start;
+                isIdStart = isXIDStart(decodeUtf8(temp));
+                skipContinuation();
+            }
+            if (isIdStart) {
+                // Read whole token. ASCII characters are scanned in a tight loop, Unicode tables are consulted only when a non-ASCII byte stops it.
+                for (;;) {
+                    const char* end = curr;
+                    while (isalnum(static_cast<unsigned char>(*end)) || *end == '_') end++;
+                    advance(end);
+                    if (static_cast<unsigned char>(*curr) < 0x80 || !nextIsXIDContinue()) break;
+                }
                 // Check if this is a keyword.
                 // First the starting letter is checked, then length, and only then comparison is performed.
                 switch (*start) {
@@ -120,15 +157,20 @@ Token Lexer::nextToken() {
                 }
                 // If no keyword matches, it is an identifier.
                 return token(TT_ID);
-            } else if (isdigit(*start)) {
-                while (!isEOF() && isdigit(*curr)) next();
+            } else if (isdigit(first)) {
+                const char* end = curr;
+                while (isdigit(static_cast<unsigned char>(*end))) end++;
                 // If after an integer literal there is a dot and another digit, then it is a float literal.
-                if (*curr == '.' && isdigit(*(curr+1))) {
-                    next();
-                    while (!isEOF() && isdigit(*curr)) next();
+                if (*end == '.' && isdigit(static_cast<unsigned char>(*(end+1)))) {
+                    end++;
+                    while (isdigit(static_cast<unsigned char>(*end))) end++;
+                    advance(end);
                     return token(TT_FLOAT);
-                } else return token(TT_INT);
+                }
+                advance(end);
+                return token(TT_INT);
             } else return token(TT_ERRCHAR); // If none ofthe patterns matches, character is unrecognized.
+        }
     }
 }
 bool Lexer::isTokenizing() {
@@ -146,7 +188,16 @@ void Lexer::skipWhitespace() {
                 curr++; break;
             case '#':
                 // `#` starts a comment, newline ends it.
-                while (!isEOF() && *curr != '\n') next();
+                for (;;) {
+                    // ASCII characters after `\n` cannot end the comment, so they are scanned with a single range check.
+                    const char* end = curr;
+                    unsigned char c;
+                    while ((c = static_cast<unsigned char>(*end)) > '\n' && c < 0x80) end++;
+                    advance(end);
+                    if (isEOF() || *curr == '\n') break;
+                    next();
+                    skipContinuation();
+                }
                 break;
             default: return;
         }
@@ -156,6 +207,21 @@ char Lexer::next() {
     column++;
     return *curr++;
 }
+void Lexer::advance(const char* end) {
+    column += static_cast<unsigned int>(end - curr);
+    curr = end;
+}
+void Lexer::skipContinuation() {
+    // Bytes of form `10xxxxxx` continue a multi-byte character and do not count to `column`.
+    while ((static_cast<unsigned char>(*curr) & 0xC0) == 0x80) curr++;
+}
+bool Lexer::nextIsXIDContinue() {
+    const char* temp = curr;
+    if (!isXIDContinue(decodeUtf8(temp))) return false;
+    next();
+    skipContinuation();
+    return true;
+}
 bool Lexer::nextIs(char c) {
     if (*curr == c) {
         next();
@@ -164,7 +230,7 @@ bool Lexer::nextIs(char c) {
     return false;
 }
 Token Lexer::token(TokenType type) {
-    return {type, start, static_cast<unsigned int>(curr - start), line, column - static_cast<unsigned int>(curr - start)};
+    return {type, start, static_cast<unsigned int>(curr - start), line, startColumn};
 }
 bool Lexer::isEOF() {
     return *curr == '\0';
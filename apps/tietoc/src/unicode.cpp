@@ -0,0 +1,341 @@
+#include <unicode.hpp>
+#include <algorithm>
+#include <cstring>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define TIETO_UTF8_SSE2
+#endif
+
+namespace {
+    // Identifier class of a range of code points.
+    enum XIDClass : uint32_t {
+        XID_NONE,       // Not allowed in identifiers
+        XID_CONTINUE,   // Allowed everywhere but at the beginning of an identifier
+        XID_START       // Allowed everywhere in an identifier
+    };
+    // Sorted table of boundaries between ranges of non-ASCII code points (Unicode 14.0).
+    // Every entry holds the first code point of a range shifted left by two bits, and the range's `XIDClass` in the lowest two bits. Range lasts until the next entry.
+    const uint32_t XID_TABLE[] = {
+    0x000002AA, 0x000002AC, 0x000002D6, 0x000002D8, 0x000002DD, 0x000002E0, 0x000002EA, 0x000002EC,
+    0x00000302, 0x0000035C, 0x00000362, 0x000003DC, 0x000003E2, 0x00000B08, 0x00000B1A, 0x00000B48,
+    0x00000B82, 0x00000B94, 0x00000BB2, 0x00000BB4, 0x00000BBA, 0x00000BBC, 0x00000C01, 0x00000DC2,
+    0x00000DD4, 0x00000DDA, 0x00000DE0, 0x00000DEE, 0x00000DF8, 0x00000DFE, 0x00000E00, 0x00000E1A,
+    0x00000E1D, 0x00000E22, 0x00000E2C, 0x00000E32, 0x00000E34, 0x00000E3A, 0x00000E88, 0x00000E8E,
+    0x00000FD8, 0x00000FDE, 0x00001208, 0x0000120D, 0x00001220, 0x0000122A, 0x000014C0, 0x000014C6,
+    0x0000155C, 0x00001566, 0x00001568, 0x00001582, 0x00001624, 0x00001645, 0x000016F8, 0x000016FD,
+    0x00001700, 0x00001705, 0x0000170C, 0x00001711, 0x00001718, 0x0000171D, 0x00001720, 0x00001742,
+    0x000017AC, 0x000017BE, 0x000017CC, 0x00001841, 0x0000186C, 0x00001882, 0x0000192D, 0x000019A8,
+    0x000019BA, 0x000019C1, 0x000019C6, 0x00001B50, 0x00001B56, 0x00001B59, 0x00001B74, 0x00001B7D,
+    0x00001B96, 0x00001B9D, 0x00001BA4, 0x00001BA9, 0x00001BBA, 0x00001BC1, 0x00001BEA, 0x00001BF4,
+    0x00001BFE, 0x00001C00, 0x00001C42, 0x00001C45, 0x00001C4A, 0x00001CC1, 0x00001D2C, 0x00001D36,
+    0x00001E99, 0x00001EC6, 0x00001EC8, 0x00001F01, 0x00001F2A, 0x00001FAD, 0x00001FD2, 0x00001FD8,
+    0x00001FEA, 0x00001FEC, 0x00001FF5, 0x00001FF8, 0x00002002, 0x00002059, 0x0000206A, 0x0000206D,
+    0x00002092, 0x00002095, 0x000020A2, 0x000020A5, 0x000020B8, 0x00002102, 0x00002165, 0x00002170,
+    0x00002182, 0x000021AC, 0x000021C2, 0x00002220, 0x00002226, 0x0000223C, 0x00002261, 0x00002282,
+    0x00002329, 0x00002388, 0x0000238D, 0x00002412, 0x000024E9, 0x000024F6, 0x000024F9, 0x00002542,
+    0x00002545, 0x00002562, 0x00002589, 0x00002590, 0x00002599, 0x000025C0, 0x000025C6, 0x00002605,
+    0x00002610, 0x00002616, 0x00002634, 0x0000263E, 0x00002644, 0x0000264E, 0x000026A4, 0x000026AA,
+    0x000026C4, 0x000026CA, 0x000026CC, 0x000026DA, 0x000026E8, 0x000026F1, 0x000026F6, 0x000026F9,
+    0x00002714, 0x0000271D, 0x00002724, 0x0000272D, 0x0000273A, 0x0000273C, 0x0000275D, 0x00002760,
+    0x00002772, 0x00002778, 0x0000277E, 0x00002789, 0x00002790, 0x00002799, 0x000027C2, 0x000027C8,
+    0x000027F2, 0x000027F4, 0x000027F9, 0x000027FC, 0x00002805, 0x00002810, 0x00002816, 0x0000282C,
+    0x0000283E, 0x00002844, 0x0000284E, 0x000028A4, 0x000028AA, 0x000028C4, 0x000028CA, 0x000028D0,
+    0x000028D6, 0x000028DC, 0x000028E2, 0x000028E8, 0x000028F1, 0x000028F4, 0x000028F9, 0x0000290C,
+    0x0000291D, 0x00002924, 0x0000292D, 0x00002938, 0x00002945, 0x00002948, 0x00002966, 0x00002974,
+    0x0000297A, 0x0000297C, 0x00002999, 0x000029CA, 0x000029D5, 0x000029D8, 0x00002A05, 0x00002A10,
+    0x00002A16, 0x00002A38, 0x00002A3E, 0x00002A48, 0x00002A4E, 0x00002AA4, 0x00002AAA, 0x00002AC4,
+    0x00002ACA, 0x00002AD0, 0x00002AD6, 0x00002AE8, 0x00002AF1, 0x00002AF6, 0x00002AF9, 0x00002B18,
+    0x00002B1D, 0x00002B28, 0x00002B2D, 0x00002B38, 0x00002B42, 0x00002B44, 0x00002B82, 0x00002B89,
+    0x00002B90, 0x00002B99, 0x00002BC0, 0x00002BE6, 0x00002BE9, 0x00002C00, 0x00002C05, 0x00002C10,
+    0x00002C16, 0x00002C34, 0x00002C3E, 0x00002C44, 0x00002C4E, 0x00002CA4, 0x00002CAA, 0x00002CC4,
+    0x00002CCA, 0x00002CD0, 0x00002CD6, 0x00002CE8, 0x00002CF1, 0x00002CF6, 0x00002CF9, 0x00002D14,
+    0x00002D1D, 0x00002D24, 0x00002D2D, 0x00002D38, 0x00002D55, 0x00002D60, 0x00002D72, 0x00002D78,
+    0x00002D7E, 0x00002D89, 0x00002D90, 0x00002D99, 0x00002DC0, 0x00002DC6, 0x00002DC8, 0x00002E09,
+    0x00002E0E, 0x00002E10, 0x00002E16, 0x00002E2C, 0x00002E3A, 0x00002E44, 0x00002E4A, 0x00002E58,
+    0x00002E66, 0x00002E6C, 0x00002E72, 0x00002E74, 0x00002E7A, 0x00002E80, 0x00002E8E, 0x00002E94,
+    0x00002EA2, 0x00002EAC, 0x00002EBA, 0x00002EE8, 0x00002EF9, 0x00002F0C, 0x00002F19, 0x00002F24,
+    0x00002F29, 0x00002F38, 0x00002F42, 0x00002F44, 0x00002F5D, 0x00002F60, 0x00002F99, 0x00002FC0,
+    0x00003001, 0x00003016, 0x00003034, 0x0000303A, 0x00003044, 0x0000304A, 0x000030A4, 0x000030AA,
+    0x000030E8, 0x000030F1, 0x000030F6, 0x000030F9, 0x00003114, 0x00003119, 0x00003124, 0x00003129,
+    0x00003138, 0x00003155, 0x0000315C, 0x00003162, 0x0000316C, 0x00003176, 0x00003178, 0x00003182,
+    0x00003189, 0x00003190, 0x00003199, 0x000031C0, 0x00003202, 0x00003205, 0x00003210, 0x00003216,
+    0x00003234, 0x0000323A, 0x00003244, 0x0000324A, 0x000032A4, 0x000032AA, 0x000032D0, 0x000032D6,
+    0x000032E8, 0x000032F1, 0x000032F6, 0x000032F9, 0x00003314, 0x00003319, 0x00003324, 0x00003329,
+    0x00003338, 0x00003355, 0x0000335C, 0x00003376, 0x0000337C, 0x00003382, 0x00003389, 0x00003390,
+    0x00003399, 0x000033C0, 0x000033C6, 0x000033CC, 0x00003401, 0x00003412, 0x00003434, 0x0000343A,
+    0x00003444, 0x0000344A, 0x000034ED, 0x000034F6, 0x000034F9, 0x00003514, 0x00003519, 0x00003524,
+    0x00003529, 0x0000353A, 0x0000353C, 0x00003552, 0x0000355D, 0x00003560, 0x0000357E, 0x00003589,
+    0x00003590, 0x00003599, 0x000035C0, 0x000035EA, 0x00003600, 0x00003605, 0x00003610, 0x00003616,
+    0x0000365C, 0x0000366A, 0x000036C8, 0x000036CE, 0x000036F0, 0x000036F6, 0x000036F8, 0x00003702,
+    0x0000371C, 0x00003729, 0x0000372C, 0x0000373D, 0x00003754, 0x00003759, 0x0000375C, 0x00003761,
+    0x00003780, 0x00003799, 0x000037C0, 0x000037C9, 0x000037D0, 0x00003806, 0x000038C5, 0x000038CA,
+    0x000038CD, 0x000038EC, 0x00003902, 0x0000391D, 0x0000393C, 0x00003941, 0x00003968, 0x00003A06,
+    0x00003A0C, 0x00003A12, 0x00003A14, 0x00003A1A, 0x00003A2C, 0x00003A32, 0x00003A90, 0x00003A96,
+    0x00003A98, 0x00003A9E, 0x00003AC5, 0x00003ACA, 0x00003ACD, 0x00003AF6, 0x00003AF8, 0x00003B02,
+    0x00003B14, 0x00003B1A, 0x00003B1C, 0x00003B21, 0x00003B38, 0x00003B41, 0x00003B68, 0x00003B72,
+    0x00003B80, 0x00003C02, 0x00003C04, 0x00003C61, 0x00003C68, 0x00003C81, 0x00003CA8, 0x00003CD5,
+    0x00003CD8, 0x00003CDD, 0x00003CE0, 0x00003CE5, 0x00003CE8, 0x00003CF9, 0x00003D02, 0x00003D20,
+    0x00003D26, 0x00003DB4, 0x00003DC5, 0x00003E14, 0x00003E19, 0x00003E22, 0x00003E35, 0x00003E60,
+    0x00003E65, 0x00003EF4, 0x00003F19, 0x00003F1C, 0x00004002, 0x000040AD, 0x000040FE, 0x00004101,
+    0x00004128, 0x00004142, 0x00004159, 0x0000416A, 0x00004179, 0x00004186, 0x00004189, 0x00004196,
+    0x0000419D, 0x000041BA, 0x000041C5, 0x000041D6, 0x00004209, 0x0000423A, 0x0000423D, 0x00004278,
+    0x00004282, 0x00004318, 0x0000431E, 0x00004320, 0x00004336, 0x00004338, 0x00004342, 0x000043EC,
+    0x000043F2, 0x00004924, 0x0000492A, 0x00004938, 0x00004942, 0x0000495C, 0x00004962, 0x00004964,
+    0x0000496A, 0x00004978, 0x00004982, 0x00004A24, 0x00004A2A, 0x00004A38, 0x00004A42, 0x00004AC4,
+    0x00004ACA, 0x00004AD8, 0x00004AE2, 0x00004AFC, 0x00004B02, 0x00004B04, 0x00004B0A, 0x00004B18,
+    0x00004B22, 0x00004B5C, 0x00004B62, 0x00004C44, 0x00004C4A, 0x00004C58, 0x00004C62, 0x00004D6C,
+    0x00004D75, 0x00004D80, 0x00004DA5, 0x00004DC8, 0x00004E02, 0x00004E40, 0x00004E82, 0x00004FD8,
+    0x00004FE2, 0x00004FF8, 0x00005006, 0x000059B4, 0x000059BE, 0x00005A00, 0x00005A06, 0x00005A6C,
+    0x00005A82, 0x00005BAC, 0x00005BBA, 0x00005BE4, 0x00005C02, 0x00005C49, 0x00005C58, 0x00005C7E,
+    0x00005CC9, 0x00005CD4, 0x00005D02, 0x00005D49, 0x00005D50, 0x00005D82, 0x00005DB4, 0x00005DBA,
+    0x00005DC4, 0x00005DC9, 0x00005DD0, 0x00005E02, 0x00005ED1, 0x00005F50, 0x00005F5E, 0x00005F60,
+    0x00005F72, 0x00005F75, 0x00005F78, 0x00005F81, 0x00005FA8, 0x0000602D, 0x00006038, 0x0000603D,
+    0x00006068, 0x00006082, 0x000061E4, 0x00006202, 0x000062A5, 0x000062AA, 0x000062AC, 0x000062C2,
+    0x000063D8, 0x00006402, 0x0000647C, 0x00006481, 0x000064B0, 0x000064C1, 0x000064F0, 0x00006519,
+    0x00006542, 0x000065B8, 0x000065C2, 0x000065D4, 0x00006602, 0x000066B0, 0x000066C2, 0x00006728,
+    0x00006741, 0x0000676C, 0x00006802, 0x0000685D, 0x00006870, 0x00006882, 0x00006955, 0x0000697C,
+    0x00006981, 0x000069F4, 0x000069FD, 0x00006A28, 0x00006A41, 0x00006A68, 0x00006A9E, 0x00006AA0,
+    0x00006AC1, 0x00006AF8, 0x00006AFD, 0x00006B3C, 0x00006C01, 0x00006C16, 0x00006CD1, 0x00006D16,
+    0x00006D34, 0x00006D41, 0x00006D68, 0x00006DAD, 0x00006DD0, 0x00006E01, 0x00006E0E, 0x00006E85,
+    0x00006EBA, 0x00006EC1, 0x00006EEA, 0x00006F99, 0x00006FD0, 0x00007002, 0x00007091, 0x000070E0,
+    0x00007101, 0x00007128, 0x00007136, 0x00007141, 0x0000716A, 0x000071F8, 0x00007202, 0x00007224,
+    0x00007242, 0x000072EC, 0x000072F6, 0x00007300, 0x00007341, 0x0000734C, 0x00007351, 0x000073A6,
+    0x000073B5, 0x000073BA, 0x000073D1, 0x000073D6, 0x000073DD, 0x000073EA, 0x000073EC, 0x00007402,
+    0x00007701, 0x00007802, 0x00007C58, 0x00007C62, 0x00007C78, 0x00007C82, 0x00007D18, 0x00007D22,
+    0x00007D38, 0x00007D42, 0x00007D60, 0x00007D66, 0x00007D68, 0x00007D6E, 0x00007D70, 0x00007D76,
+    0x00007D78, 0x00007D7E, 0x00007DF8, 0x00007E02, 0x00007ED4, 0x00007EDA, 0x00007EF4, 0x00007EFA,
+    0x00007EFC, 0x00007F0A, 0x00007F14, 0x00007F1A, 0x00007F34, 0x00007F42, 0x00007F50, 0x00007F5A,
+    0x00007F70, 0x00007F82, 0x00007FB4, 0x00007FCA, 0x00007FD4, 0x00007FDA, 0x00007FF4, 0x000080FD,
+    0x00008104, 0x00008151, 0x00008154, 0x000081C6, 0x000081C8, 0x000081FE, 0x00008200, 0x00008242,
+    0x00008274, 0x00008341, 0x00008374, 0x00008385, 0x00008388, 0x00008395, 0x000083C4, 0x0000840A,
+    0x0000840C, 0x0000841E, 0x00008420, 0x0000842A, 0x00008450, 0x00008456, 0x00008458, 0x00008462,
+    0x00008478, 0x00008492, 0x00008494, 0x0000849A, 0x0000849C, 0x000084A2, 0x000084A4, 0x000084AA,
+    0x000084E8, 0x000084F2, 0x00008500, 0x00008516, 0x00008528, 0x0000853A, 0x0000853C, 0x00008582,
+    0x00008624, 0x0000B002, 0x0000B394, 0x0000B3AE, 0x0000B3BD, 0x0000B3CA, 0x0000B3D0, 0x0000B402,
+    0x0000B498, 0x0000B49E, 0x0000B4A0, 0x0000B4B6, 0x0000B4B8, 0x0000B4C2, 0x0000B5A0, 0x0000B5BE,
+    0x0000B5C0, 0x0000B5FD, 0x0000B602, 0x0000B65C, 0x0000B682, 0x0000B69C, 0x0000B6A2, 0x0000B6BC,
+    0x0000B6C2, 0x0000B6DC, 0x0000B6E2, 0x0000B6FC, 0x0000B702, 0x0000B71C, 0x0000B722, 0x0000B73C,
+    0x0000B742, 0x0000B75C, 0x0000B762, 0x0000B77C, 0x0000B781, 0x0000B800, 0x0000C016, 0x0000C020,
+    0x0000C086, 0x0000C0A9, 0x0000C0C0, 0x0000C0C6, 0x0000C0D8, 0x0000C0E2, 0x0000C0F4, 0x0000C106,
+    0x0000C25C, 0x0000C265, 0x0000C26C, 0x0000C276, 0x0000C280, 0x0000C286, 0x0000C3EC, 0x0000C3F2,
+    0x0000C400, 0x0000C416, 0x0000C4C0, 0x0000C4C6, 0x0000C63C, 0x0000C682, 0x0000C700, 0x0000C7C2,
+    0x0000C800, 0x0000D002, 0x00013700, 0x00013802, 0x00029234, 0x00029342, 0x000293F8, 0x00029402,
+    0x00029834, 0x00029842, 0x00029881, 0x000298AA, 0x000298B0, 0x00029902, 0x000299BD, 0x000299C0,
+    0x000299D1, 0x000299F8, 0x000299FE, 0x00029A79, 0x00029A82, 0x00029BC1, 0x00029BC8, 0x00029C5E,
+    0x00029C80, 0x00029C8A, 0x00029E24, 0x00029E2E, 0x00029F2C, 0x00029F42, 0x00029F48, 0x00029F4E,
+    0x00029F50, 0x00029F56, 0x00029F68, 0x00029FCA, 0x0002A009, 0x0002A00E, 0x0002A019, 0x0002A01E,
+    0x0002A02D, 0x0002A032, 0x0002A08D, 0x0002A0A0, 0x0002A0B1, 0x0002A0B4, 0x0002A102, 0x0002A1D0,
+    0x0002A201, 0x0002A20A, 0x0002A2D1, 0x0002A318, 0x0002A341, 0x0002A368, 0x0002A381, 0x0002A3CA,
+    0x0002A3E0, 0x0002A3EE, 0x0002A3F0, 0x0002A3F6, 0x0002A3FD, 0x0002A42A, 0x0002A499, 0x0002A4B8,
+    0x0002A4C2, 0x0002A51D, 0x0002A550, 0x0002A582, 0x0002A5F4, 0x0002A601, 0x0002A612, 0x0002A6CD,
+    0x0002A704, 0x0002A73E, 0x0002A741, 0x0002A768, 0x0002A782, 0x0002A795, 0x0002A79A, 0x0002A7C1,
+    0x0002A7EA, 0x0002A7FC, 0x0002A802, 0x0002A8A5, 0x0002A8DC, 0x0002A902, 0x0002A90D, 0x0002A912,
+    0x0002A931, 0x0002A938, 0x0002A941, 0x0002A968, 0x0002A982, 0x0002A9DC, 0x0002A9EA, 0x0002A9ED,
+    0x0002A9FA, 0x0002AAC1, 0x0002AAC6, 0x0002AAC9, 0x0002AAD6, 0x0002AADD, 0x0002AAE6, 0x0002AAF9,
+    0x0002AB02, 0x0002AB05, 0x0002AB0A, 0x0002AB0C, 0x0002AB6E, 0x0002AB78, 0x0002AB82, 0x0002ABAD,
+    0x0002ABC0, 0x0002ABCA, 0x0002ABD5, 0x0002ABDC, 0x0002AC06, 0x0002AC1C, 0x0002AC26, 0x0002AC3C,
+    0x0002AC46, 0x0002AC5C, 0x0002AC82, 0x0002AC9C, 0x0002ACA2, 0x0002ACBC, 0x0002ACC2, 0x0002AD6C,
+    0x0002AD72, 0x0002ADA8, 0x0002ADC2, 0x0002AF8D, 0x0002AFAC, 0x0002AFB1, 0x0002AFB8, 0x0002AFC1,
+    0x0002AFE8, 0x0002B002, 0x00035E90, 0x00035EC2, 0x00035F1C, 0x00035F2E, 0x00035FF0, 0x0003E402,
+    0x0003E9B8, 0x0003E9C2, 0x0003EB68, 0x0003EC02, 0x0003EC1C, 0x0003EC4E, 0x0003EC60, 0x0003EC76,
+    0x0003EC79, 0x0003EC7E, 0x0003ECA4, 0x0003ECAA, 0x0003ECDC, 0x0003ECE2, 0x0003ECF4, 0x0003ECFA,
+    0x0003ECFC, 0x0003ED02, 0x0003ED08, 0x0003ED0E, 0x0003ED14, 0x0003ED1A, 0x0003EEC8, 0x0003EF4E,
+    0x0003F178, 0x0003F192, 0x0003F4F8, 0x0003F542, 0x0003F640, 0x0003F64A, 0x0003F720, 0x0003F7C2,
+    0x0003F7E8, 0x0003F801, 0x0003F840, 0x0003F881, 0x0003F8C0, 0x0003F8CD, 0x0003F8D4, 0x0003F935,
+    0x0003F940, 0x0003F9C6, 0x0003F9C8, 0x0003F9CE, 0x0003F9D0, 0x0003F9DE, 0x0003F9E0, 0x0003F9E6,
+    0x0003F9E8, 0x0003F9EE, 0x0003F9F0, 0x0003F9F6, 0x0003F9F8, 0x0003F9FE, 0x0003FBF4, 0x0003FC41,
+    0x0003FC68, 0x0003FC86, 0x0003FCEC, 0x0003FCFD, 0x0003FD00, 0x0003FD06, 0x0003FD6C, 0x0003FD9A,
+    0x0003FE79, 0x0003FE82, 0x0003FEFC, 0x0003FF0A, 0x0003FF20, 0x0003FF2A, 0x0003FF40, 0x0003FF4A,
+    0x0003FF60, 0x0003FF6A, 0x0003FF74, 0x00040002, 0x00040030, 0x00040036, 0x0004009C, 0x000400A2,
+    0x000400EC, 0x000400F2, 0x000400F8, 0x000400FE, 0x00040138, 0x00040142, 0x00040178, 0x00040202,
+    0x000403EC, 0x00040502, 0x000405D4, 0x000407F5, 0x000407F8, 0x00040A02, 0x00040A74, 0x00040A82,
+    0x00040B44, 0x00040B81, 0x00040B84, 0x00040C02, 0x00040C80, 0x00040CB6, 0x00040D2C, 0x00040D42,
+    0x00040DD9, 0x00040DEC, 0x00040E02, 0x00040E78, 0x00040E82, 0x00040F10, 0x00040F22, 0x00040F40,
+    0x00040F46, 0x00040F58, 0x00041002, 0x00041278, 0x00041281, 0x000412A8, 0x000412C2, 0x00041350,
+    0x00041362, 0x000413F0, 0x00041402, 0x000414A0, 0x000414C2, 0x00041590, 0x000415C2, 0x000415EC,
+    0x000415F2, 0x0004162C, 0x00041632, 0x0004164C, 0x00041652, 0x00041658, 0x0004165E, 0x00041688,
+    0x0004168E, 0x000416C8, 0x000416CE, 0x000416E8, 0x000416EE, 0x000416F4, 0x00041802, 0x00041CDC,
+    0x00041D02, 0x00041D58, 0x00041D82, 0x00041DA0, 0x00041E02, 0x00041E18, 0x00041E1E, 0x00041EC4,
+    0x00041ECA, 0x00041EEC, 0x00042002, 0x00042018, 0x00042022, 0x00042024, 0x0004202A, 0x000420D8,
+    0x000420DE, 0x000420E4, 0x000420F2, 0x000420F4, 0x000420FE, 0x00042158, 0x00042182, 0x000421DC,
+    0x00042202, 0x0004227C, 0x00042382, 0x000423CC, 0x000423D2, 0x000423D8, 0x00042402, 0x00042458,
+    0x00042482, 0x000424E8, 0x00042602, 0x000426E0, 0x000426FA, 0x00042700, 0x00042802, 0x00042805,
+    0x00042810, 0x00042815, 0x0004281C, 0x00042831, 0x00042842, 0x00042850, 0x00042856, 0x00042860,
+    0x00042866, 0x000428D8, 0x000428E1, 0x000428EC, 0x000428FD, 0x00042900, 0x00042982, 0x000429F4,
+    0x00042A02, 0x00042A74, 0x00042B02, 0x00042B20, 0x00042B26, 0x00042B95, 0x00042B9C, 0x00042C02,
+    0x00042CD8, 0x00042D02, 0x00042D58, 0x00042D82, 0x00042DCC, 0x00042E02, 0x00042E48, 0x00043002,
+    0x00043124, 0x00043202, 0x000432CC, 0x00043302, 0x000433CC, 0x00043402, 0x00043491, 0x000434A0,
+    0x000434C1, 0x000434E8, 0x00043A02, 0x00043AA8, 0x00043AAD, 0x00043AB4, 0x00043AC2, 0x00043AC8,
+    0x00043C02, 0x00043C74, 0x00043C9E, 0x00043CA0, 0x00043CC2, 0x00043D19, 0x00043D44, 0x00043DC2,
+    0x00043E09, 0x00043E18, 0x00043EC2, 0x00043F14, 0x00043F82, 0x00043FDC, 0x00044001, 0x0004400E,
+    0x000440E1, 0x0004411C, 0x00044199, 0x000441C6, 0x000441CD, 0x000441D6, 0x000441D8, 0x000441FD,
+    0x0004420E, 0x000442C1, 0x000442EC, 0x00044309, 0x0004430C, 0x00044342, 0x000443A4, 0x000443C1,
+    0x000443E8, 0x00044401, 0x0004440E, 0x0004449D, 0x000444D4, 0x000444D9, 0x00044500, 0x00044512,
+    0x00044515, 0x0004451E, 0x00044520, 0x00044542, 0x000445CD, 0x000445D0, 0x000445DA, 0x000445DC,
+    0x00044601, 0x0004460E, 0x000446CD, 0x00044706, 0x00044714, 0x00044725, 0x00044734, 0x00044739,
+    0x0004476A, 0x0004476C, 0x00044772, 0x00044774, 0x00044802, 0x00044848, 0x0004484E, 0x000448B1,
+    0x000448E0, 0x000448F9, 0x000448FC, 0x00044A02, 0x00044A1C, 0x00044A22, 0x00044A24, 0x00044A2A,
+    0x00044A38, 0x00044A3E, 0x00044A78, 0x00044A7E, 0x00044AA4, 0x00044AC2, 0x00044B7D, 0x00044BAC,
+    0x00044BC1, 0x00044BE8, 0x00044C01, 0x00044C10, 0x00044C16, 0x00044C34, 0x00044C3E, 0x00044C44,
+    0x00044C4E, 0x00044CA4, 0x00044CAA, 0x00044CC4, 0x00044CCA, 0x00044CD0, 0x00044CD6, 0x00044CE8,
+    0x00044CED, 0x00044CF6, 0x00044CF9, 0x00044D14, 0x00044D1D, 0x00044D24, 0x00044D2D, 0x00044D38,
+    0x00044D42, 0x00044D44, 0x00044D5D, 0x00044D60, 0x00044D76, 0x00044D89, 0x00044D90, 0x00044D99,
+    0x00044DB4, 0x00044DC1, 0x00044DD4, 0x00045002, 0x000450D5, 0x0004511E, 0x0004512C, 0x00045141,
+    0x00045168, 0x00045179, 0x0004517E, 0x00045188, 0x00045202, 0x000452C1, 0x00045312, 0x00045318,
+    0x0004531E, 0x00045320, 0x00045341, 0x00045368, 0x00045602, 0x000456BD, 0x000456D8, 0x000456E1,
+    0x00045704, 0x00045762, 0x00045771, 0x00045778, 0x00045802, 0x000458C1, 0x00045904, 0x00045912,
+    0x00045914, 0x00045941, 0x00045968, 0x00045A02, 0x00045AAD, 0x00045AE2, 0x00045AE4, 0x00045B01,
+    0x00045B28, 0x00045C02, 0x00045C6C, 0x00045C75, 0x00045CB0, 0x00045CC1, 0x00045CE8, 0x00045D02,
+    0x00045D1C, 0x00046002, 0x000460B1, 0x000460EC, 0x00046282, 0x00046381, 0x000463A8, 0x000463FE,
+    0x0004641C, 0x00046426, 0x00046428, 0x00046432, 0x00046450, 0x00046456, 0x0004645C, 0x00046462,
+    0x000464C1, 0x000464D8, 0x000464DD, 0x000464E4, 0x000464ED, 0x000464FE, 0x00046501, 0x00046506,
+    0x00046509, 0x00046510, 0x00046541, 0x00046568, 0x00046682, 0x000466A0, 0x000466AA, 0x00046745,
+    0x00046760, 0x00046769, 0x00046786, 0x00046788, 0x0004678E, 0x00046791, 0x00046794, 0x00046802,
+    0x00046805, 0x0004682E, 0x000468CD, 0x000468EA, 0x000468ED, 0x000468FC, 0x0004691D, 0x00046920,
+    0x00046942, 0x00046945, 0x00046972, 0x00046A29, 0x00046A68, 0x00046A76, 0x00046A78, 0x00046AC2,
+    0x00046BE4, 0x00047002, 0x00047024, 0x0004702A, 0x000470BD, 0x000470DC, 0x000470E1, 0x00047102,
+    0x00047104, 0x00047141, 0x00047168, 0x000471CA, 0x00047240, 0x00047249, 0x000472A0, 0x000472A5,
+    0x000472DC, 0x00047402, 0x0004741C, 0x00047422, 0x00047428, 0x0004742E, 0x000474C5, 0x000474DC,
+    0x000474E9, 0x000474EC, 0x000474F1, 0x000474F8, 0x000474FD, 0x0004751A, 0x0004751D, 0x00047520,
+    0x00047541, 0x00047568, 0x00047582, 0x00047598, 0x0004759E, 0x000475A4, 0x000475AA, 0x00047629,
+    0x0004763C, 0x00047641, 0x00047648, 0x0004764D, 0x00047662, 0x00047664, 0x00047681, 0x000476A8,
+    0x00047B82, 0x00047BCD, 0x00047BDC, 0x00047EC2, 0x00047EC4, 0x00048002, 0x00048E68, 0x00049002,
+    0x000491BC, 0x00049202, 0x00049510, 0x0004BE42, 0x0004BFC4, 0x0004C002, 0x0004D0BC, 0x00051002,
+    0x0005191C, 0x0005A002, 0x0005A8E4, 0x0005A902, 0x0005A97C, 0x0005A981, 0x0005A9A8, 0x0005A9C2,
+    0x0005AAFC, 0x0005AB01, 0x0005AB28, 0x0005AB42, 0x0005ABB8, 0x0005ABC1, 0x0005ABD4, 0x0005AC02,
+    0x0005ACC1, 0x0005ACDC, 0x0005AD02, 0x0005AD10, 0x0005AD41, 0x0005AD68, 0x0005AD8E, 0x0005ADE0,
+    0x0005ADF6, 0x0005AE40, 0x0005B902, 0x0005BA00, 0x0005BC02, 0x0005BD2C, 0x0005BD3D, 0x0005BD42,
+    0x0005BD45, 0x0005BE20, 0x0005BE3D, 0x0005BE4E, 0x0005BE80, 0x0005BF82, 0x0005BF88, 0x0005BF8E,
+    0x0005BF91, 0x0005BF94, 0x0005BFC1, 0x0005BFC8, 0x0005C002, 0x00061FE0, 0x00062002, 0x00063358,
+    0x00063402, 0x00063424, 0x0006BFC2, 0x0006BFD0, 0x0006BFD6, 0x0006BFF0, 0x0006BFF6, 0x0006BFFC,
+    0x0006C002, 0x0006C48C, 0x0006C542, 0x0006C54C, 0x0006C592, 0x0006C5A0, 0x0006C5C2, 0x0006CBF0,
+    0x0006F002, 0x0006F1AC, 0x0006F1C2, 0x0006F1F4, 0x0006F202, 0x0006F224, 0x0006F242, 0x0006F268,
+    0x0006F275, 0x0006F27C, 0x00073C01, 0x00073CB8, 0x00073CC1, 0x00073D1C, 0x00074595, 0x000745A8,
+    0x000745B5, 0x000745CC, 0x000745ED, 0x0007460C, 0x00074615, 0x00074630, 0x000746A9, 0x000746B8,
+    0x00074909, 0x00074914, 0x00075002, 0x00075154, 0x0007515A, 0x00075274, 0x0007527A, 0x00075280,
+    0x0007528A, 0x0007528C, 0x00075296, 0x0007529C, 0x000752A6, 0x000752B4, 0x000752BA, 0x000752E8,
+    0x000752EE, 0x000752F0, 0x000752F6, 0x00075310, 0x00075316, 0x00075418, 0x0007541E, 0x0007542C,
+    0x00075436, 0x00075454, 0x0007545A, 0x00075474, 0x0007547A, 0x000754E8, 0x000754EE, 0x000754FC,
+    0x00075502, 0x00075514, 0x0007551A, 0x0007551C, 0x0007552A, 0x00075544, 0x0007554A, 0x00075A98,
+    0x00075AA2, 0x00075B04, 0x00075B0A, 0x00075B6C, 0x00075B72, 0x00075BEC, 0x00075BF2, 0x00075C54,
+    0x00075C5A, 0x00075CD4, 0x00075CDA, 0x00075D3C, 0x00075D42, 0x00075DBC, 0x00075DC2, 0x00075E24,
+    0x00075E2A, 0x00075EA4, 0x00075EAA, 0x00075F0C, 0x00075F12, 0x00075F30, 0x00075F39, 0x00076000,
+    0x00076801, 0x000768DC, 0x000768ED, 0x000769B4, 0x000769D5, 0x000769D8, 0x00076A11, 0x00076A14,
+    0x00076A6D, 0x00076A80, 0x00076A85, 0x00076AC0, 0x00077C02, 0x00077C7C, 0x00078001, 0x0007801C,
+    0x00078021, 0x00078064, 0x0007806D, 0x00078088, 0x0007808D, 0x00078094, 0x00078099, 0x000780AC,
+    0x00078402, 0x000784B4, 0x000784C1, 0x000784DE, 0x000784F8, 0x00078501, 0x00078528, 0x0007853A,
+    0x0007853C, 0x00078A42, 0x00078AB9, 0x00078ABC, 0x00078B02, 0x00078BB1, 0x00078BE8, 0x00079F82,
+    0x00079F9C, 0x00079FA2, 0x00079FB0, 0x00079FB6, 0x00079FBC, 0x00079FC2, 0x00079FFC, 0x0007A002,
+    0x0007A314, 0x0007A341, 0x0007A35C, 0x0007A402, 0x0007A511, 0x0007A52E, 0x0007A530, 0x0007A541,
+    0x0007A568, 0x0007B802, 0x0007B810, 0x0007B816, 0x0007B880, 0x0007B886, 0x0007B88C, 0x0007B892,
+    0x0007B894, 0x0007B89E, 0x0007B8A0, 0x0007B8A6, 0x0007B8CC, 0x0007B8D2, 0x0007B8E0, 0x0007B8E6,
+    0x0007B8E8, 0x0007B8EE, 0x0007B8F0, 0x0007B90A, 0x0007B90C, 0x0007B91E, 0x0007B920, 0x0007B926,
+    0x0007B928, 0x0007B92E, 0x0007B930, 0x0007B936, 0x0007B940, 0x0007B946, 0x0007B94C, 0x0007B952,
+    0x0007B954, 0x0007B95E, 0x0007B960, 0x0007B966, 0x0007B968, 0x0007B96E, 0x0007B970, 0x0007B976,
+    0x0007B978, 0x0007B97E, 0x0007B980, 0x0007B986, 0x0007B98C, 0x0007B992, 0x0007B994, 0x0007B99E,
+    0x0007B9AC, 0x0007B9B2, 0x0007B9CC, 0x0007B9D2, 0x0007B9E0, 0x0007B9E6, 0x0007B9F4, 0x0007B9FA,
+    0x0007B9FC, 0x0007BA02, 0x0007BA28, 0x0007BA2E, 0x0007BA70, 0x0007BA86, 0x0007BA90, 0x0007BA96,
+    0x0007BAA8, 0x0007BAAE, 0x0007BAF0, 0x0007EFC1, 0x0007EFE8, 0x00080002, 0x000A9B80, 0x000A9C02,
+    0x000ADCE4, 0x000ADD02, 0x000AE078, 0x000AE082, 0x000B3A88, 0x000B3AC2, 0x000BAF84, 0x000BE002,
+    0x000BE878, 0x000C0002, 0x000C4D2C, 0x00380401, 0x003807C0
+    };
+
+    // Function returning identifier class of the non-ASCII code point by binary search over `XID_TABLE`.
+    XIDClass xidClass(uint32_t codepoint) {
+        const uint32_t* end = XID_TABLE + sizeof(XID_TABLE) / sizeof(*XID_TABLE);
+        // Searching for the first boundary above the code point, so that the previous one is the range containing it.
+        const uint32_t* it = std::upper_bound(XID_TABLE, end, (codepoint << 2) | 3u);
+        if (it == XID_TABLE) return XID_NONE;
+        return static_cast<XIDClass>(*(it - 1) & 3u);
+    }
+    // Function returning length of the valid UTF-8 sequence starting at `src`, or 0 if it is malformed. `end` bounds the sequence.
+    // Rejects overlong encodings, surrogates and code points above U+10FFFF as required by RFC 3629.
+    std::size_t sequenceLength(const unsigned char* src, const unsigned char* end) {
+        unsigned char lead = *src;
+        std::size_t length;
+        // Allowed range of the second byte depends on the leading byte.
+        unsigned char low = 0x80, high = 0xBF;
+        if (lead < 0x80) return 1;
+        else if (lead < 0xC2) return 0;
+        else if (lead < 0xE0) length = 2;
+        else if (lead < 0xF0) {
+            length = 3;
+            if (lead == 0xE0) low = 0xA0;
+            else if (lead == 0xED) high = 0x9F;
+        } else if (lead < 0xF5) {
+            length = 4;
+            if (lead == 0xF0) low = 0x90;
+            else if (lead == 0xF4) high = 0x8F;
+        } else return 0;
+        if (static_cast<std::size_t>(end - src) < length) return 0;
+        if (src[1] < low || src[1] > high) return 0;
+        for (std::size_t i = 2; i < length; i++) if ((src[i] & 0xC0) != 0x80) return 0;
+        return length;
+    }
+}
+
+const char* validateUtf8(const char* src, std::size_t length) {
+    const unsigned char* curr = reinterpret_cast<const unsigned char*>(src);
+    const unsigned char* end = curr + length;
+    while (curr < end) {
+        // ASCII fast path: skip whole blocks without any byte having the highest bit set.
+#ifdef TIETO_UTF8_SSE2
+        // Four blocks are checked at once, so that long ASCII runs cost a single branch per 64 bytes.
+        while (end - curr >= 64) {
+            const __m128i* blocks = reinterpret_cast<const __m128i*>(curr);
+            __m128i any = _mm_or_si128(_mm_or_si128(_mm_loadu_si128(blocks), _mm_loadu_si128(blocks + 1)), _mm_or_si128(_mm_loadu_si128(blocks + 2), _mm_loadu_si128(blocks + 3)));
+            if (_mm_movemask_epi8(any) != 0) break;
+            curr += 64;
+        }
+        while (end - curr >= 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(curr));
+            int mask = _mm_movemask_epi8(block);
+            if (mask != 0) {
+                // Jump straight to the first non-ASCII byte in the block.
+                int offset = 0;
+                while (!(mask & (1 << offset))) offset++;
+                curr += offset;
+                break;
+            }
+            curr += 16;
+        }
+#else
+        while (end - curr >= 8) {
+            uint64_t block;
+            std::memcpy(&block, curr, sizeof(block));
+            if (block & 0x8080808080808080ull) break;
+            curr += 8;
+        }
+#endif
+        if (curr == end) break;
+        // Non-ASCII bytes (and the tail shorter than a block) are validated sequence by sequence.
+        std::size_t sequence = sequenceLength(curr, end);
+        if (sequence == 0) return reinterpret_cast<const char*>(curr);
+        curr += sequence;
+    }
+    return nullptr;
+}
+uint32_t decodeUtf8(const char*& src) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(src);
+    uint32_t codepoint;
+    if (bytes[0] < 0x80) {
+        src += 1;
+        return bytes[0];
+    } else if (bytes[0] < 0xE0) {
+        codepoint = ((bytes[0] & 0x1Fu) << 6) | (bytes[1] & 0x3Fu);
+        src += 2;
+    } else if (bytes[0] < 0xF0) {
+        codepoint = ((bytes[0] & 0x0Fu) << 12) | ((bytes[1] & 0x3Fu) << 6) | (bytes[2] & 0x3Fu);
+        src += 3;
+    } else {
+        codepoint = ((bytes[0] & 0x07u) << 18) | ((bytes[1] & 0x3Fu) << 12) | ((bytes[2] & 0x3Fu) << 6) | (bytes[3] & 0x3Fu);
+        src += 4;
+    }
+    return codepoint;
+}
+bool isXIDStart(uint32_t codepoint) {
+    return xidClass(codepoint) == XID_START;
+}
+bool isXIDContinue(uint32_t codepoint) {
+    return xidClass(codepoint) != XID_NONE;
+}